@@ -76,7 +76,6 @@
 #pragma config CP = OFF         // PFM and Data EEPROM Code Protection bit (PFM and Data EEPROM code protection disabled)
 
 #include <xc.h>
-#include "C:\Program Files\Microchip\xc8\v3.00\pic\include\proc\pic18f47k42.h"
 
 #define _XTAL_FREQ 2000000  // 2 MHz clock for delay
 
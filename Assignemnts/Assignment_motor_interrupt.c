@@ -22,7 +22,6 @@
 //-----------------------------------------------------------------
 
 #include <xc.h>
-#include "C:\Program Files\Microchip\xc8\v3.00\pic\include\proc\pic18f47k42.h"
 
 #define _XTAL_FREQ 2000000
 